@@ -111,6 +111,9 @@ tvError_t TvInit();
  * right video format value detected. When the primary video playback stops, the TVSettings
  * HAL will callback notifying SDR format as the default.
  *
+ * The callback is invoked from the HAL event dispatcher thread and never from the driver context.
+ * Please refer to the Asynchronous Notification Model of the HAL specification.
+ *
  * @param[in] cbData                - Callback data. Please refer ::tvVideoFormatCallbackData
  *
  * @retval tvERROR_NONE            - Success
@@ -135,6 +138,9 @@ tvError_t RegisterVideoFormatChangeCB(tvVideoFormatCallbackData *cbData);
  * Tuner video sources. AVI Infoframes for HDMI sources will be handled in dsHDMIIn through
  * dsHdmiInRegisterAviContentTypeChangeCB.
  *
+ * The callback is invoked from the HAL event dispatcher thread and never from the driver context.
+ * Please refer to the Asynchronous Notification Model of the HAL specification.
+ *
  * @param[in] cbData                - Callback data. Please refer::tvVideoContentCallbackData
  *
  * @retval tvERROR_NONE            - Success
@@ -155,6 +161,9 @@ tvError_t RegisterVideoContentChangeCB(tvVideoContentCallbackData *cbData);
  * right video resolution value detected. When the primary video playback stops, the TVSettings
  * HAL will not make any callback.
  *
+ * The callback is invoked from the HAL event dispatcher thread and never from the driver context.
+ * Please refer to the Asynchronous Notification Model of the HAL specification.
+ *
  * @param[in] cbData                - Callback data. Please refer ::tvVideoResolutionCallbackData
  *
  * @retval tvERROR_NONE            - Success
@@ -175,6 +184,9 @@ tvError_t RegisterVideoResolutionChangeCB(tvVideoResolutionCallbackData *cbData)
  * right video framerate value detected. When the primary video playback stops, the TVSettings
  * HAL will not make any callback.
  *
+ * The callback is invoked from the HAL event dispatcher thread and never from the driver context.
+ * Please refer to the Asynchronous Notification Model of the HAL specification.
+ *
  * @param[in] cbData                - Callback function. Please refer ::tvVideoFrameRateCallbackData
  *
  * @return tvError_t
@@ -188,6 +200,67 @@ tvError_t RegisterVideoResolutionChangeCB(tvVideoResolutionCallbackData *cbData)
  */
 tvError_t RegisterVideoFrameRateChangeCB(tvVideoFrameRateCallbackData *cbData);
 
+/**
+ * @brief Registers a video signal change subscriber
+ *
+ * This function adds a subscriber for consolidated video signal change events. Unlike the single callback of
+ * RegisterVideoFormatChangeCB(), RegisterVideoResolutionChangeCB() and RegisterVideoFrameRateChangeCB(), up to
+ * VIDEO_SIGNAL_SUBSCRIBERS_MAX subscribers can be registered, and they are notified in registration order.
+ *
+ * A source change such as an HDMI hot-plug produces resolution, framerate and format changes within milliseconds.
+ * All changes detected within `coalesceWindowMs` of the first one are merged into a single callback carrying the
+ * final format, resolution and framerate, with `changedMask` telling which of them changed. The window starts
+ * at the first change, so a continuous stream of changes cannot delay the callback indefinitely.
+ *
+ * The callback is invoked from the HAL event dispatcher thread and never from the driver context.
+ *
+ * This function may be called from within a video signal change callback. It does not wait for the dispatcher,
+ * and the new subscriber is first notified at the next dispatch, not at the one in progress.
+ *
+ * @param[in] cbData                - Callback data. Please refer ::tvVideoSignalCallbackData
+ * @param[out] handle               - Subscriber handle to be passed to UnregisterVideoSignalChangeCB()
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE            - Success
+ * @retval tvERROR_INVALID_PARAM   - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE   - Interface is not initialized
+ * @retval tvERROR_GENERAL         - Underlying failures - SoC, memory, VIDEO_SIGNAL_SUBSCRIBERS_MAX reached, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see UnregisterVideoSignalChangeCB()
+ */
+tvError_t RegisterVideoSignalChangeCB(tvVideoSignalCallbackData *cbData, int *handle);
+
+/**
+ * @brief Unregisters a video signal change subscriber
+ *
+ * This function removes a subscriber added by RegisterVideoSignalChangeCB(). The callback of the subscriber
+ * will not be invoked again after the function returns.
+ *
+ * When called from any other thread, the function waits until a running invocation of the subscriber's callback
+ * has returned, so that the caller may release the callback's userdata. This is the one documented exception to the
+ * no blocking calls rule of the HAL specification, and the wait is bounded by the run time of that callback. When called from within a video signal
+ * change callback, i.e. on the dispatcher thread, it does not wait and returns immediately. A subscriber may
+ * therefore unregister itself or another subscriber from its callback without deadlocking. Subscribers removed
+ * this way are skipped for the rest of the dispatch in progress.
+ *
+ * @param[in] handle                - Subscriber handle returned by RegisterVideoSignalChangeCB()
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE            - Success
+ * @retval tvERROR_INVALID_PARAM   - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE   - Interface is not initialized
+ * @retval tvERROR_GENERAL         - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see RegisterVideoSignalChangeCB()
+ */
+tvError_t UnregisterVideoSignalChangeCB(int handle);
+
 
 /**
  * @brief Gets supported video formats of the system.
@@ -429,6 +502,10 @@ tvError_t SaveBacklight(tvVideoSrcType_t videoSrcType, int pq_mode,tvVideoFormat
  * picture mode change or primary video source change or primary video format change, the fading stops instantly
  * and system jumps to the new backlight value.
  *
+ * The fade is stepped by a HAL thread at the rate and with the curve set by SetBacklightFadeCurve(), linear at the panel
+ * refresh rate by default. A new SetBacklightFade() call, or any of the changes above, cancels the running fade in O(1).
+ * The cancel waits for at most one fade step that is being written to the driver, and never for the rest of the fade.
+ *
  * @param[in] from                  - Percentage of current backlight value from where fade starts. Valid range is (0 - 100)
  *                                  - If the value is <100 then before fade starts the backlight will jump to the from % of the currently @n
  *                                   set backlight value.
@@ -450,6 +527,7 @@ tvError_t SetBacklightFade(int from,int to,int duration);
  * @brief Gets the backlight fade settings
  *
  * This function returns current backlight fade settings and the progress level of the fade.
+ * The values are read without taking a lock, so this function never waits for the fade thread.
  *
  * @param[out] from                  - Percentage of current backlight value from where fade starts. Valid range is (0 - 100)
  * @param[out] to                    - Percentage of current backlight value where fade ends. Valid range is (0 - 100)
@@ -466,6 +544,52 @@ tvError_t SetBacklightFade(int from,int to,int duration);
  */
 tvError_t GetCurrentBacklightFade(int *from,int *to,int *current);
 
+/**
+ * @brief Sets the backlight fade curve and step rate
+ *
+ * This function sets how subsequent SetBacklightFade() calls step the backlight from the start to the end value.
+ * A fade already in progress is not affected. The setting is not saved and reverts to the default on TvInit().
+ *
+ * @param[in] curve                 - Fade curve. Valid value will be a member of ::tvBacklightFadeCurve_t
+ *                                  - Default is tvBacklightFadeCurve_LINEAR
+ * @param[in] stepRate              - Number of backlight updates per second. Valid range is (1 - panel refresh rate)
+ *                                  - 0 selects the panel refresh rate, which is the default
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE             - Success
+ * @retval tvERROR_INVALID_PARAM    - Input parameter is invalid
+ * @retval tvERROR_INVALID_STATE    - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED   - Operation is not supported
+ * @retval tvERROR_GENERAL          - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see SetBacklightFade(), GetBacklightFadeCurve()
+ */
+tvError_t SetBacklightFadeCurve(tvBacklightFadeCurve_t curve, unsigned int stepRate);
+
+/**
+ * @brief Gets the backlight fade curve and step rate
+ *
+ * This function returns the fade curve and step rate set by SetBacklightFadeCurve().
+ *
+ * @param[out] curve                - Fade curve. Valid value will be a member of ::tvBacklightFadeCurve_t
+ * @param[out] stepRate             - Number of backlight updates per second
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE             - Success
+ * @retval tvERROR_INVALID_PARAM    - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE    - Interface is not initialized
+ * @retval tvERROR_GENERAL          - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see SetBacklightFadeCurve()
+ */
+tvError_t GetBacklightFadeCurve(tvBacklightFadeCurve_t *curve, unsigned int *stepRate);
+
 /**
  * @brief Gets the supported backlight modes
  *
@@ -1597,6 +1721,8 @@ tvError_t GetDynamicContrast(char *isDynamicContrastEnabled);
  * This function sets the global dynamic gamma value. Currently loaded 2.2 gamma is shifted as per the
  * new dynamic gamma value passed. The dynamic gamma value is saved for future use. Any reload of new gamma curve (as a result of
  * colour temperature change) should be followed by shifting of the new gamma curve based on the dynamic gamma value.
+ * Curves computed for a dynamic gamma value should be cached, so that setting a recently used value again
+ * does not recompute the curve.
  *
  * @param[in] tvGammaValue  - The dynamic Gamma value to be applied. Valid values range from 1.80 till 2.60
  *
@@ -1789,6 +1915,11 @@ tvError_t GetTVPictureMode(char *pictureMode);
  * picture mode and all the associated picture properties will be reloaded again when the current video source and current
  * primary video format are selected in future.
  *
+ * Only the picture properties whose value differs between the outgoing and the incoming picture mode shall be written
+ * to the driver. Gamma, white balance and TMAX are resolved for the incoming context, including its video source,
+ * picture mode, video format, colour temperature and local dimming level, and are reloaded only if the resolved
+ * values differ from the applied ones. The number of driver writes avoided is reported by GetPQApplyStats().
+ *
  * @param[in] pictureMode           - Picture mode to be set.Valid values are as per values
  *                                    returned by ::pic_modes_t.name  parmaeter from GetTVSupportedPictureModes API.
  *                                    The size of string will be PIC_MODE_NAME_MAX.
@@ -2214,10 +2345,18 @@ tvError_t GetCurrentWBCalibrationMode(bool *value);
  * will be discarded and default value from picture profile database is used on colour temperature value change as a result of picture mode change or primary video source
  * change or primary vidoe format change.
  *
+ * Entry i of each array is the output for input code i of an 8 bit signal, so each array must hold 256 entries.
+ * For 10 bit input the table is expanded to 1024 points by linear interpolation between neighbouring entries,
+ * with the last entry repeated:
+ * out[x] = (t[x >> 2] * (4 - (x & 3)) + t[min((x >> 2) + 1, 255)] * (x & 3) + 2) >> 2.
+ *
  * @param[in] pData_R       - Array of gamma red values. Valid range is (0 - 1023)
  * @param[in] pData_G       - Array of gamma green values. Valid range is (0 - 1023)
  * @param[in] pData_B       - Array of gamma blue values. Valid range is (0 - 1023)
- * @param[in] size          - Common size of each array. Valid range is (0 - 256)
+ * @param[in] size          - Common size of each array. Valid value is 256
+ *
+ * @note Earlier versions of this interface accepted a size of 0 to 256. Any size other than 256 now
+ *       returns tvERROR_INVALID_PARAM.
  *
  * @return tvError_t
  *
@@ -2239,7 +2378,7 @@ tvError_t SetGammaTable(unsigned short *pData_R, unsigned short *pData_G, unsign
  * @param[out] pData_R        - Array of gamma red values. Valid range is (0 - 1023)
  * @param[out] pData_G        - Array of gamma green values. Valid range is (0 - 1023)
  * @param[out] pData_B        - Array of gamma blue values. Valid range is (0 - 1023)
- * @param[in] size           - Common size of each array. Valid range is (0 - 256)
+ * @param[in] size           - Common size of each array. Valid value is 256, as for SetGammaTable()
  *
  * @return tvError_t
  *
@@ -2260,7 +2399,7 @@ tvError_t GetDefaultGammaTable(tvColorTemp_t colortemp, unsigned short *pData_R,
  * @param[out] pData_R        - Array of gamma red values. Valid range is (0 - 1023)
  * @param[out] pData_G        - Array of gamma green values. Valid range is (0 - 1023)
  * @param[out] pData_B        - Array of gamma blue values. Valid range is (0 - 1023)
- * @param[in] size           - Common size of each array. Valid range is (0 - 256)
+ * @param[in] size           - Common size of each array. Valid value is 256, as for SetGammaTable()
  *
  * @return tvError_t
  *
@@ -2281,10 +2420,13 @@ tvError_t GetGammaTable(unsigned short *pData_R, unsigned short *pData_G, unsign
  * as a result of picture mode change or primary video source change or primary vidoe format change.
  *
  * @param[in] colortemp       - Color temperature. Valid value will be member of ::tvColorTemp_t
- * @param[out] pData_R        - Array of gamma red values. Valid range is (0 - 1023)
- * @param[out] pData_G        - Array of gamma green values. Valid range is (0 - 1023)
- * @param[out] pData_B        - Array of gamma blue values. Valid range is (0 - 1023)
- * @param[out] size           - Common size of each array. Valid range is (0 - 256)
+ * @param[in] pData_R         - Array of gamma red values. Valid range is (0 - 1023)
+ * @param[in] pData_G         - Array of gamma green values. Valid range is (0 - 1023)
+ * @param[in] pData_B         - Array of gamma blue values. Valid range is (0 - 1023)
+ * @param[in] size            - Common size of each array. Valid value is 256, as for SetGammaTable()
+ *
+ * @note Earlier versions of this interface accepted a size of 0 to 256. Any size other than 256 now
+ *       returns tvERROR_INVALID_PARAM.
  *
  * @return tvError_t
  *
@@ -2303,6 +2445,7 @@ tvError_t SaveGammaTable(tvColorTemp_t colortemp, unsigned short *pData_R, unsig
  * This function sets the Dolby vision TMAX paramaeter in the Dolby vision core, but will not be saved in picture profile database.
  * The value is discarded and default value from picture profile database is used when primary video format
  * or primary video source or picture mode changes.
+ * TMAX is the target peak luminance in cd/m² of the tone mapping curve, for HDR10, HLG and DV alike.
  *
  * @param[in] value       - Value of the TMAX to be set. Valid range is (0 to 10000)
  *
@@ -2644,7 +2787,8 @@ tvError_t GetCMSState(bool *enableCMSState);
  * @brief Gets the PQ Setting parameters
  *
  * This function returns the override values for various PQ Setting parameters for a given picture mode index, primary video source @n
- * and primary video format.
+ * and primary video format. If no override value has been saved for the parameter, the value from the default picture @n
+ * profile database is returned, as GetDefaultPQParams() would.
  *
  * @param[in] pqIndex               - Picture mode index value. Valid values will be a member of ::tvPQModeIndex_t
  * @param[in] videoSrcType          - Source input value. Valid value will be a member of ::tvVideoSrcType_t
@@ -3029,6 +3173,50 @@ tvError_t EnableLocalContrast(bool mode);
  */
 tvError_t GetLdimZoneShortCircuitStatus(unsigned char* shortcircuit_zone_list, unsigned int size, int* status);
 
+/**
+ * @brief Retrieves the short circuit status of the LDIM zones as a bitmap.
+ *
+ * On calling GetLdimZoneShortCircuitBitmap, the short circuit detection logic is triggered
+ * as for GetLdimZoneShortCircuitStatus(). The result is returned bit-packed, one bit per zone,
+ * together with a sorted list of the failing zone indices, so a caller polling a panel with
+ * thousands of zones does not need to scan one byte per zone.
+ *
+ * Zone i is reported in bit (i % 32) of zone_bitmap[i / 32]. All bits at and above the number of
+ * dimming zones, up to the end of zone_bitmap[bitmap_words - 1], are set to 0. The failing zone list is
+ * built from the bitmap with population count and count trailing zeros operations, skipping empty words.
+ *
+ * The HAL keeps one baseline of the zone status for the whole process. It is reset to all zones healthy
+ * by TvInit(). When changed_only is true, a bit is set only for zones whose status differs from the
+ * baseline, the list holds those zones, and the baseline is then updated to the detected status.
+ * Calls with changed_only false report the detected status and neither read nor update the baseline,
+ * so a diagnostic full read does not hide changes from a caller polling with changed_only true.
+ *
+ * @param[out] zone_bitmap              Pre-allocated array receiving one bit per zone.
+ *                                        0 - No short circuit detected (or unchanged, if changed_only).
+ *                                        1 - Short circuit detected (or changed, if changed_only).
+ * @param[in]  bitmap_words             Number of elements in zone_bitmap. Must be at least
+ *                                      (number of dimming zones + 31) / 32.
+ * @param[out] failing_zones            Pre-allocated array receiving the indices of the zones set in
+ *                                      zone_bitmap, in ascending order. May be NULL if max_failing_zones is 0.
+ * @param[in]  max_failing_zones        Number of elements in failing_zones.
+ * @param[out] num_failing_zones        Total number of zones set in zone_bitmap. If it exceeds
+ *                                      max_failing_zones, only the first max_failing_zones indices are returned.
+ * @param[in]  changed_only             Report only zones whose status changed since the previous call
+ *                                      with changed_only true.
+ *
+ * @return tvError_t
+ * @retval tvERROR_NONE                    Short circuit detection completed successfully.
+ * @retval tvERROR_INVALID_PARAM           Invalid input parameter.
+ * @retval tvERROR_INVALID_STATE           Detection logic failed to execute.
+ * @retval tvERROR_GENERAL                 Underlying failures (SoC, memory, etc.).
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED Operation is not supported on this platform.
+ *
+ * @see GetLdimZoneShortCircuitStatus(), GetNumberOfDimmingZones()
+ *
+ * @pre TvInit() should be called before calling this API.
+ */
+tvError_t GetLdimZoneShortCircuitBitmap(unsigned int* zone_bitmap, unsigned int bitmap_words, unsigned int* failing_zones, unsigned int max_failing_zones, unsigned int* num_failing_zones, bool changed_only);
+
 /**
  * @brief Retrieves the number of dimming zones supported by the platform.
  *
@@ -3049,6 +3237,31 @@ tvError_t GetLdimZoneShortCircuitStatus(unsigned char* shortcircuit_zone_list, u
  */
 tvError_t GetNumberOfDimmingZones(unsigned int* number_of_dimming_zones);
 
+/**
+ * @brief Retrieves the layout of the dimming zones.
+ *
+ * On calling GetDimmingZoneLayout, the API retrieves how the dimming zones are arranged
+ * behind the panel. Zones form a regular grid and are numbered row by row, starting at the
+ * top left zone, in the same order as used by GetLdimZoneShortCircuitStatus().
+ * The product of rows and columns equals the value returned by GetNumberOfDimmingZones().
+ * An edge-lit panel reports a single row or a single column.
+ *
+ * @param[out] rows                     Number of zone rows.
+ * @param[out] columns                  Number of zone columns.
+ *
+ * @return tvError_t
+ * @retval tvERROR_NONE                    The zone layout was retrieved successfully.
+ * @retval tvERROR_INVALID_PARAM           Invalid input parameter (e.g., rows or columns is NULL).
+ * @retval tvERROR_INVALID_STATE           Interface is not initialized.
+ * @retval tvERROR_GENERAL                 Underlying failures (e.g., hardware issues, memory errors).
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED The platform does not support dimming zones.
+ *
+ * @see GetNumberOfDimmingZones()
+ *
+ * @pre TvInit() should be called before calling this API.
+ */
+tvError_t GetDimmingZoneLayout(unsigned int* rows, unsigned int* columns);
+
  /**
  * @brief Sets 2Point Custom WhiteBalance
  *
@@ -3938,6 +4151,46 @@ tvError_t SetMultiPointWBMatrix(tvColorTemp_t colorTemp, tvPQModeIndex_t pq_mode
 */
 tvError_t GetMultiPointWBMatrix(tvColorTemp_t colorTemp, tvPQModeIndex_t pq_mode, tvVideoFormatType_t videoFormatType, tvVideoSrcType_t videoSrcType, int * r, int * g, int * b);
 
+/**
+ * @brief Sets the multi-point white balance red, green and blue values of a single UI matrix point.
+ *
+ * This function moves one point of the UI matrix and updates the HAL matrix in the picture profile database for the
+ * specific picture mode, color temperature, primary video format and primary video source, as SetMultiPointWBMatrix() would.
+ * It is intended for live slider adjustment, where only one UI point changes at a time.
+ *
+ * The HAL matrix is derived from the UI points at the positions returned by GetMultiPointWBCaps() by monotone piecewise cubic
+ * Hermite (PCHIP) interpolation, for the red, green and blue channels together. Moving UI point i changes the slopes at
+ * points i-1, i and i+1 only, so just the HAL matrix points between UI points i-2 and i+2 are recomputed and
+ * applied. The UI point values are the HAL matrix values at the UI positions; they are re-derived whenever
+ * SetMultiPointWBMatrix() sets the whole matrix.
+ *
+ * The matrix values are applied in the PQ module if the current picture mode, primary video format and primary video source match the parameters.
+ *
+ * If the platform does not support multi-point white balance, then tvERROR_OPERATION_NOT_SUPPORTED is returned.
+ *
+ * @param[in] colorTemp       - Color temperature type value. Valid value will be a member of ::tvColorTemp_t
+ * @param[in] pq_mode         - Picture mode index. Valid value will be a member of ::tvPQModeIndex_t
+ * @param[in] videoFormatType - Video format type value. Valid value will be a member of ::tvVideoFormatType_t
+ * @param[in] videoSrcType    - Source input value. Valid value will be a member of ::tvVideoSrcType_t
+ * @param[in] ui_point_index  - Index of the UI point. Valid range is (0 - `num_ui_matrix_points` - 1) as returned by GetMultiPointWBCaps().
+ * @param[in] r               - Red value. Must be `rgb_min` <= r <= `rgb_max` as returned by GetMultiPointWBCaps().
+ * @param[in] g               - Green value. Must be `rgb_min` <= g <= `rgb_max` as returned by GetMultiPointWBCaps().
+ * @param[in] b               - Blue value. Must be `rgb_min` <= b <= `rgb_max` as returned by GetMultiPointWBCaps().
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE - Success
+ * @retval tvERROR_INVALID_PARAM - Input parameter is invalid
+ * @retval tvERROR_INVALID_STATE - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED - Operation is not supported
+ * @retval tvERROR_GENERAL - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see SetMultiPointWBMatrix(), GetMultiPointWBCaps()
+ */
+tvError_t SetMultiPointWBUIPoint(tvColorTemp_t colorTemp, tvPQModeIndex_t pq_mode, tvVideoFormatType_t videoFormatType, tvVideoSrcType_t videoSrcType, int ui_point_index, int r, int g, int b);
+
 /**
  * @brief Gets the Dolby Vision PQ Calibration setting capabilities supported by the platform.
  *
@@ -4528,6 +4781,173 @@ tvError_t SetBacklightDimmingLevel(tvVideoSrcType_t videoSrcType, tvPQModeIndex_
  */
 tvError_t GetBacklightDimmingLevel(tvVideoSrcType_t videoSrcType, tvPQModeIndex_t pq_mode, tvVideoFormatType_t videoFormatType, int * dimmingLevel);
 
+/**
+ * @brief Gets the supported configuration contexts of a PQ parameter as a bitmap.
+ *
+ * This function returns a dense bitmap built from the "context" section of the feature in pq_capabilities.json.
+ * The bitmap describes the same contexts as the `context_caps` returned by the matching Get*Caps() function,
+ * e.g. GetBrightnessCaps() for PQ_PARAM_BRIGHTNESS. Callers can validate a context with CONTEXT_BITMAP_TEST()
+ * instead of scanning the `tvContextCaps_t` array.
+ *
+ * If this feature is global (`num_contexts == 0`) and platform_support is true, the bitmap shall be
+ * built from the picturemode section of pq_capabilities.json.
+ *
+ * The bitmap returned by this call is allocated by the HAL function and shall
+ * be safe to reference for the lifetime of the process.
+ *
+ * If the platform does not support the PQ parameter, then tvERROR_OPERATION_NOT_SUPPORTED is returned.
+ *
+ * @param[in] pqParamIndex     - The PQ parameter enum. Valid value will be a member of ::tvPQParameterIndex_t
+ * @param[out] context_bitmap  - A bitmap of the configuration contexts supported. Please refer ::tvContextBitmap_t
+ *                             - The returned bitmap must not be freed by the caller.
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE - Success
+ * @retval tvERROR_INVALID_PARAM - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED - Operation is not supported
+ * @retval tvERROR_GENERAL - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ */
+tvError_t GetContextCapsBitmap(tvPQParameterIndex_t pqParamIndex, tvContextBitmap_t ** context_bitmap);
+
+/**
+ * @brief Saves a batch of PQ parameter values.
+ *
+ * This function saves several PQ parameter values in the picture profile database in a single transaction.
+ * Each entry behaves as the matching scalar Save function, e.g. SaveBrightness() for PQ_PARAM_BRIGHTNESS,
+ * SaveCMS() for the PQ_PARAM_CMS_* parameters and SaveCustom2PointWhiteBalance() for the PQ_PARAM_WB_* parameters.
+ * There will be no change in the current values applied in PQ module.
+ *
+ * All entries are validated against the ranges and contexts returned by the Get*Caps() functions
+ * before any entry is saved. If any entry is invalid, no entry is saved and tvERROR_INVALID_PARAM is returned.
+ * The saved values are committed to persistent storage with a single flush once all entries are applied,
+ * so a picture mode reset or a profile import costs one storage write instead of one per parameter.
+ *
+ * Parameters that are not a single integer value (PQ_PARAM_MULTI_POINT_WB, PQ_PARAM_DOLBY_VISION_CALIBRATION)
+ * cannot be saved with this function.
+ *
+ * An entry may use wildcards: VIDEO_SOURCE_ALL for all video sources, PQ_MODE_INVALID for all picture modes and
+ * VIDEO_FORMAT_NONE for all video formats. A wildcard entry is expanded by intersecting it with the
+ * ::tvContextBitmap_t of the parameter, as returned by GetContextCapsBitmap(), and the value is written to every
+ * resulting context in one pass. Contexts the parameter does not support are skipped. If the intersection is empty,
+ * tvERROR_INVALID_PARAM is returned. Wildcard entries are part of the same single transaction as the other entries.
+ *
+ * Because VIDEO_FORMAT_NONE is always treated as the wildcard, the VIDEO_FORMAT_NONE contexts cannot be saved
+ * individually with this function. Use the single parameter Save* functions, e.g. SaveBrightness(), for them.
+ *
+ * @param[in] entries          - Array of entries to be saved. Please refer ::tvPQParamEntry_t
+ * @param[in] num_entries      - Number of elements in the 'entries' array. Must be greater than 0.
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE                      - Success
+ * @retval tvERROR_INVALID_PARAM             - Input parameter is invalid
+ * @retval tvERROR_INVALID_STATE             - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED   - Operation is not supported
+ * @retval tvERROR_GENERAL                   - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ */
+tvError_t SavePQParamsBatch(tvPQParamEntry_t * entries, size_t num_entries);
+
+/**
+ * @brief Gets the PQ apply statistics.
+ *
+ * This function returns counters describing how picture properties were applied to the driver on picture mode,
+ * primary video source and primary video format changes. The HAL compares the outgoing and incoming picture property
+ * values and writes only the changed ones; the skipped writes are counted in tvPQApplyStats_t.driver_writes_avoided.
+ *
+ * @param[out] stats               - PQ apply statistics. Please refer ::tvPQApplyStats_t
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE            - Success
+ * @retval tvERROR_INVALID_PARAM   - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE   - Interface is not initialized
+ * @retval tvERROR_GENERAL         - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ */
+tvError_t GetPQApplyStats(tvPQApplyStats_t *stats);
+
+/**
+ * @brief Gets the per-API call statistics.
+ *
+ * This function returns call counters and latency percentiles for every API of this interface that has been called
+ * at least once since TvInit(). The statistics are only collected when the HAL is built with TVSETTINGS_HAL_STATS
+ * defined. Without it no instrumentation is compiled in and tvERROR_OPERATION_NOT_SUPPORTED is returned.
+ *
+ * Recording a call must not take a lock, so that the instrumentation does not add blocking to any API.
+ *
+ * To size the 'stats' array the caller may first call this function with 'stats' NULL and 'max_stats' 0,
+ * and read 'total_stats'. If 'total_stats' is greater than 'max_stats' the result is truncated.
+ *
+ * @param[out] stats               - Caller allocated array that receives the statistics. Please refer ::tvApiStats_t
+ *                                   May be NULL if 'max_stats' is 0
+ * @param[in] max_stats            - Number of elements in the 'stats' array
+ * @param[out] num_stats           - Number of elements written to the 'stats' array
+ * @param[out] total_stats         - Number of APIs with statistics available
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE                      - Success
+ * @retval tvERROR_INVALID_PARAM             - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE             - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED   - HAL is built without TVSETTINGS_HAL_STATS
+ * @retval tvERROR_GENERAL                   - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see DumpTvSettingsStats()
+ */
+tvError_t GetTvSettingsStats(tvApiStats_t *stats, size_t max_stats, size_t *num_stats, size_t *total_stats);
+
+/**
+ * @brief Dumps the per-API call statistics to a file.
+ *
+ * This function writes the statistics returned by GetTvSettingsStats() to a text file, one API per line,
+ * followed by the counters returned by GetPQApplyStats(). An existing file is overwritten.
+ *
+ * @param[in] filePath             - Path of the file to be written
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE                      - Success
+ * @retval tvERROR_INVALID_PARAM             - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE             - Interface is not initialized
+ * @retval tvERROR_OPERATION_NOT_SUPPORTED   - HAL is built without TVSETTINGS_HAL_STATS
+ * @retval tvERROR_GENERAL                   - Underlying failures - SoC, memory, file system, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ *
+ * @see GetTvSettingsStats()
+ */
+tvError_t DumpTvSettingsStats(const char *filePath);
+
+/**
+ * @brief Gets the video event dispatch statistics.
+ *
+ * This function returns the delivery statistics of one type of video change event. Driver notifications are
+ * published to a per event type mailbox slot and delivered to the registered callbacks from a dispatcher thread;
+ * the latency is measured from the time the driver notification is published until the callback returns.
+ *
+ * @param[in] eventType            - Video event type. Valid value will be a member of ::tvVideoEventType_t
+ * @param[out] stats               - Video event statistics. Please refer ::tvVideoEventStats_t
+ *
+ * @return tvError_t
+ *
+ * @retval tvERROR_NONE            - Success
+ * @retval tvERROR_INVALID_PARAM   - Parameter is invalid
+ * @retval tvERROR_INVALID_STATE   - Interface is not initialized
+ * @retval tvERROR_GENERAL         - Underlying failures - SoC, memory, etc
+ *
+ * @pre TvInit() should be called before calling this API
+ */
+tvError_t GetVideoEventStats(tvVideoEventType_t eventType, tvVideoEventStats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
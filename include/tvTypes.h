@@ -409,6 +409,19 @@ typedef enum tvPQParameterIndex {
     PQ_PARAM_MAX                               //!< End of enum
 }tvPQParameterIndex_t;
 
+#define PQ_PARAM_TABLE_ENTRIES (VIDEO_SOURCE_MAX * VIDEO_FORMAT_MAX * PQ_MODE_MAX * PQ_PARAM_MAX)  //!< Defines the number of cells in a dense picture property table
+
+/**
+ * @brief Index of a cell in a dense picture property table.
+ *
+ * The picture property table is laid out as one contiguous array indexed
+ * [videoSrcType][videoFormatType][pq_mode][pqParamIndex], so a lookup is a single multiply-add.
+ * All arguments must be valid members of their enumerations, wildcard values are not allowed.
+ */
+#define PQ_PARAM_TABLE_INDEX(videoSrcType, videoFormatType, pq_mode, pqParamIndex) \
+    (((((unsigned int)(videoSrcType) * VIDEO_FORMAT_MAX) + (unsigned int)(videoFormatType)) * PQ_MODE_MAX + \
+      (unsigned int)(pq_mode)) * PQ_PARAM_MAX + (unsigned int)(pqParamIndex))
+
 /**
  *  @brief Enumeration defining the various supported dolby modes
  *  This enum will be deprecated and switched to tvPQModeIndex_t
@@ -462,6 +475,18 @@ typedef enum tvBacklightTestMode_s{
     tvBacklightTestMode_Max             //!< End of enum
 }tvBacklightTestMode_t;
 
+/**
+ * @brief Enumeration defining the supported backlight fade curves
+ *
+ */
+typedef enum
+{
+    tvBacklightFadeCurve_LINEAR = 0,    //!< Backlight changes by the same amount on every step
+    tvBacklightFadeCurve_PERCEPTUAL,    //!< Backlight follows a gamma 2.2 curve, so the perceived brightness changes linearly
+    tvBacklightFadeCurve_EASE_IN_OUT,   //!< Backlight starts and ends the fade slowly (smoothstep)
+    tvBacklightFadeCurve_MAX            //!< End of enum
+}tvBacklightFadeCurve_t;
+
 /**
  * @brief Callback for tvVideoFormatChangeCB
  *
@@ -577,6 +602,53 @@ typedef struct
     tvVideoFrameRateChangeCB cb;                //!< Video frame change call back function pointed
 }tvVideoFrameRateCallbackData;
 
+#define VIDEO_SIGNAL_SUBSCRIBERS_MAX (8)        //!< Defines the maximum number of video signal change subscribers
+
+/**
+ * @brief Enumeration defining the video signal properties reported by a video signal change
+ *
+ */
+typedef enum
+{
+    tvVideoSignalChange_NONE = 0x00,           //!< No change
+    tvVideoSignalChange_FORMAT = 0x01,         //!< Video format changed
+    tvVideoSignalChange_RESOLUTION = 0x02,     //!< Video resolution changed
+    tvVideoSignalChange_FRAMERATE = 0x04,      //!< Video framerate changed
+    tvVideoSignalChange_MAX = 0x08             //!< End of enum
+}tvVideoSignalChange_t;
+
+/**
+ * @brief Structure for the consolidated video signal state.
+ */
+typedef struct
+{
+    tvVideoFormatType_t format;                 //!< Current video format
+    tvResolutionParam_t resolution;             //!< Current video resolution
+    tvVideoFrameRate_t frameRate;               //!< Current video framerate
+    unsigned int changedMask;                   //!< Bitwise OR of ::tvVideoSignalChange_t values that changed since the previous callback
+}tvVideoSignalInfo_t;
+
+/**
+ * @brief Callback for tvVideoSignalChangeCB.
+ *
+ * This callback is triggered once for a burst of video format, resolution and framerate changes.
+ *
+ * @param[in] signalInfo          - Consolidated video signal state. Valid values will be member of ::tvVideoSignalInfo_t
+ * @param[in] userData            - Data of the content
+ *
+ */
+typedef void (*tvVideoSignalChangeCB)(tvVideoSignalInfo_t signalInfo,void *userData);
+
+/**
+ * @brief Structure for video signal change callback data.
+ */
+typedef struct
+{
+    void *userdata;                             //!< User data passed back to caller during call back
+    tvVideoSignalChangeCB cb;                   //!< Video signal change call back function pointed
+    unsigned int coalesceWindowMs;              //!< Changes within this window are merged into one callback. 0 disables the window and delivers the latest state at each dispatch
+}tvVideoSignalCallbackData;
+
 /**
  * @brief Enumeration defining the supported WhiteBalance Color
  *
@@ -606,6 +678,8 @@ typedef enum
  * This struct holds calibration settings including
  * maximum and minimum temperature settings (Tmax, Tmin), gamma correction (Tgamma),
  * and RGBW color coordinate values (Rx, Ry, Gx, Gy, Bx, By, Wx, Wy).
+ * The HAL derives the panel RGB to XYZ matrices and the EOTF from these values, and memoises the
+ * results per distinct settings value.
  */
 typedef struct {
     double Tmax, Tmin,
@@ -643,6 +717,10 @@ typedef struct {
  * the corresponding pqmode, source, and format entries should be retrieved from the picturemode section
  * of pq_capabilities.json
  *
+ * The structure and the @c contexts array are owned by the HAL. They may reside in a
+ * read-only mapping of the capability image, so the caller must not modify or free them.
+ * Features with an identical set of contexts may share the same structure.
+ *
  * @param num_contexts Number of entries in the @c contexts array (0 = global only).
  * @param contexts     Pointer to an array of configuration contexts.
  */
@@ -652,12 +730,70 @@ typedef struct
     tvConfigContext_t *contexts;     /**< Array of supported contexts */
 } tvContextCaps_t;
 
+#define CONTEXT_BITMAP_BITS  (PQ_MODE_MAX * VIDEO_FORMAT_MAX * VIDEO_SOURCE_MAX)  //!< Defines the number of contexts a bitmap can describe
+#define CONTEXT_BITMAP_WORDS ((CONTEXT_BITMAP_BITS + 31) / 32)                   //!< Defines the number of 32 bit words in a context bitmap
+
+/**
+ * @brief Bit position of a context in a ::tvContextBitmap_t.
+ *
+ * All arguments must be valid members of their enumerations. Wildcard values such as
+ * VIDEO_SOURCE_ALL or PQ_MODE_INVALID have no bit position.
+ */
+#define CONTEXT_BITMAP_INDEX(pq_mode, videoFormatType, videoSrcType) \
+    ((((unsigned int)(pq_mode) * VIDEO_FORMAT_MAX) + (unsigned int)(videoFormatType)) * VIDEO_SOURCE_MAX + (unsigned int)(videoSrcType))
+
+/**
+ * @brief Tests whether a context is set in a ::tvContextBitmap_t. Evaluates to 1 if set, otherwise 0.
+ */
+#define CONTEXT_BITMAP_TEST(bitmap, pq_mode, videoFormatType, videoSrcType) \
+    (((bitmap)->bits[CONTEXT_BITMAP_INDEX(pq_mode, videoFormatType, videoSrcType) / 32] >> \
+      (CONTEXT_BITMAP_INDEX(pq_mode, videoFormatType, videoSrcType) % 32)) & 1u)
+
+/**
+ * @brief Dense bitmap of the configuration contexts supported by a feature.
+ *
+ * Holds the same information as the @c contexts array of ::tvContextCaps_t, with one bit
+ * per (pq_mode, videoFormatType, videoSrcType) combination. Checking whether a context is
+ * supported is a single bit test with CONTEXT_BITMAP_TEST() instead of a scan of the array.
+ *
+ * @param bits Bit array indexed by CONTEXT_BITMAP_INDEX(). Bits are stored least significant bit first in each word.
+ */
+typedef struct
+{
+    unsigned int bits[CONTEXT_BITMAP_WORDS]; /**< One bit per supported context */
+} tvContextBitmap_t;
+
+/**
+ * @brief Structure for a single entry of a batched PQ parameter save.
+ *
+ * Describes one picture profile database cell and the value to be saved into it.
+ * A wildcard in videoSrcType, pq_mode or videoFormatType selects every supported cell
+ * of that dimension. Used by SavePQParamsBatch().
+ *
+ * VIDEO_FORMAT_NONE is also a valid video format with its own cells. In an entry it always acts as
+ * the wildcard, so the cells of the VIDEO_FORMAT_NONE contexts alone cannot be addressed here and
+ * must be saved with the single parameter Save* functions, e.g. SaveBrightness().
+ */
+typedef struct
+{
+    tvPQParameterIndex_t pqParamIndex;      /**< PQ parameter to be saved. Valid value will be a member of tvPQParameterIndex_t */
+    tvVideoSrcType_t     videoSrcType;      /**< Valid video source from tvVideoSrcType_t, or VIDEO_SOURCE_ALL for all sources */
+    tvPQModeIndex_t      pq_mode;           /**< Valid picture mode from tvPQModeIndex_t, or PQ_MODE_INVALID for all picture modes */
+    tvVideoFormatType_t  videoFormatType;   /**< Valid video format from tvVideoFormatType_t, or VIDEO_FORMAT_NONE for all video formats */
+    int                  value;             /**< Value to be saved. Valid range is as returned by the Get*Caps() function of the parameter */
+} tvPQParamEntry_t;
+
 /**
  * @brief Enum for SDR Gamma values.
  *
  * This enum defines the possible values for SDR gamma correction,
  * including invalid, specific gamma values (1.8 to 2.4), ITU-R BT.1886 standard,
  * and the maximum boundary of the enum.
+ *
+ * The power law values describe the curve out = in ^ gamma on normalised code values.
+ * tvSdrGamma_BT_1886 uses the ITU-R BT.1886 EOTF with the panel's white and black luminance.
+ * The power law curves are fixed, so implementations are expected to precompute them at build time.
+ * The BT.1886 curve depends on the panel and is computed once at TvInit().
  */
 typedef enum
 {
@@ -693,6 +829,75 @@ typedef enum {
     tvDVCalibrationComponent_MAX        //!< Calibration Component is MAX
 } tvDVCalibrationComponent_t;
 
+/**
+ * @brief Structure for the PQ apply statistics.
+ *
+ * Counters are cumulative since TvInit(). An apply is triggered by SetTVPictureMode() or by a change of
+ * the primary video source or primary video format, and pushes the resolved picture properties to the driver.
+ * Apply latency is measured from the trigger until the last driver write of the apply has completed.
+ */
+typedef struct
+{
+    unsigned long long num_applies;              //!< Number of applies performed
+    unsigned long long params_compared;          //!< Number of parameters compared between the outgoing and incoming contexts
+    unsigned long long driver_writes;            //!< Number of parameters written to the driver
+    unsigned long long driver_writes_avoided;    //!< Number of parameter writes skipped because the value was unchanged
+    unsigned long long plan_cache_hits;          //!< Number of applies served from a cached apply plan
+    unsigned long long plan_cache_misses;        //!< Number of applies that had to resolve the picture profile database
+    unsigned long long plan_cache_invalidations; //!< Number of cached apply plans discarded by Save calls
+    unsigned long long apply_p50_ns;             //!< 50th percentile apply latency in nanoseconds
+    unsigned long long apply_p99_ns;             //!< 99th percentile apply latency in nanoseconds
+    unsigned long long apply_max_ns;             //!< Maximum apply latency in nanoseconds
+} tvPQApplyStats_t;
+
+#define TV_API_NAME_MAX (48)                   //!< Defines the maximum API name length in tvApiStats_t
+
+/**
+ * @brief Structure for the call statistics of one TV Settings HAL API.
+ *
+ * Latencies are measured from entry to return of the API and reported in nanoseconds.
+ * Percentiles are taken from a log-linear latency histogram, so they are accurate to the bucket width.
+ */
+typedef struct
+{
+    char api_name[TV_API_NAME_MAX];              //!< Name of the API, e.g. "SetBrightness"
+    unsigned long long call_count;               //!< Number of calls since TvInit()
+    unsigned long long error_count;              //!< Number of calls that returned a value other than tvERROR_NONE
+    unsigned long long p50_ns;                   //!< 50th percentile latency in nanoseconds
+    unsigned long long p99_ns;                   //!< 99th percentile latency in nanoseconds
+    unsigned long long max_ns;                   //!< Maximum latency in nanoseconds
+} tvApiStats_t;
+
+/**
+ * @brief Enumeration defining the video change event types
+ *
+ */
+typedef enum
+{
+    tvVideoEvent_FORMAT = 0,                   //!< Video format change, delivered to tvVideoFormatChangeCB
+    tvVideoEvent_CONTENT,                      //!< Video content change, delivered to tvVideoContentChangeCB
+    tvVideoEvent_RESOLUTION,                   //!< Video resolution change, delivered to tvVideoResolutionChangeCB
+    tvVideoEvent_FRAMERATE,                    //!< Video framerate change, delivered to tvVideoFrameRateChangeCB
+    tvVideoEvent_SIGNAL,                       //!< Consolidated video signal change, delivered to tvVideoSignalChangeCB
+    tvVideoEvent_MAX                           //!< End of enum
+}tvVideoEventType_t;
+
+/**
+ * @brief Structure for the dispatch statistics of one video event type.
+ *
+ * Counters are cumulative since TvInit(). Latency is measured from the time the driver notification
+ * is published until the callback returns, and reported in nanoseconds.
+ */
+typedef struct
+{
+    unsigned long long published;                //!< Number of driver notifications published
+    unsigned long long delivered;                //!< Number of notifications delivered to the callback
+    unsigned long long dropped;                  //!< Number of notifications overwritten by a newer one before delivery
+    unsigned long long p50_ns;                   //!< 50th percentile publish-to-delivery latency in nanoseconds
+    unsigned long long p99_ns;                   //!< 99th percentile publish-to-delivery latency in nanoseconds
+    unsigned long long max_ns;                   //!< Maximum publish-to-delivery latency in nanoseconds
+} tvVideoEventStats_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,13 @@ extern "C"
 {
 #endif
 
+/**
+ * @brief Structure for the calibrated gamma offsets of the red, green and blue channels.
+ *
+ * Each channel holds 256 entries indexed by the 8 bit input code. The channels are stored as
+ * separate arrays so that a lookup kernel can process one channel of many pixels at once.
+ * For 10 bit input the entries are interpolated as described for SetGammaTable().
+ */
 typedef struct _gammaCalibrated {
      unsigned short r_gamma_offset[256];
      unsigned short g_gamma_offset[256];